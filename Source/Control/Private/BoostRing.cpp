@@ -0,0 +1,21 @@
+// Remy Pijuan 2024.
+
+#include "BoostRing.h"
+#include "Net/UnrealNetwork.h"
+
+void ABoostRing::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ABoostRing, BoostStrength);
+}
+
+void ABoostRing::SetBoostStrength(float NewBoostStrength)
+{
+	if (HasAuthority() && BoostStrength != NewBoostStrength)
+	{
+		// Flush first so dormant clients receive the new strength
+		FlushNetDormancy();
+		BoostStrength = NewBoostStrength;
+	}
+}
@@ -0,0 +1,31 @@
+// Remy Pijuan 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CourseActor.h"
+#include "BoostRing.generated.h"
+
+/**
+ * Course actor that boosts flying players through it (see AControlCharacter::ApplyBoost).
+ */
+UCLASS()
+class ABoostRing : public ACourseActor
+{
+	GENERATED_BODY()
+
+public:
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// Change the velocity added to players passing through (server only)
+	UFUNCTION(BlueprintCallable, Category=Boost)
+	void SetBoostStrength(float NewBoostStrength);
+
+	UFUNCTION(BlueprintPure, Category=Boost)
+	float GetBoostStrength() const { return BoostStrength; }
+
+protected:
+	// The velocity added along the ring's forward vector when a player passes through
+	UPROPERTY(EditAnywhere, Replicated, Category=Boost)
+	float BoostStrength = 50000.f;
+};
@@ -1,6 +1,7 @@
 // Remy Pijuan 2024.
 
 #include "ControlCharacter.h"
+#include "BoostRing.h"
 #include "Components/CapsuleComponent.h"
 #include "EnhancedInputComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -357,12 +358,23 @@ void AControlCharacter::StopFlying()
 void AControlCharacter::ApplyBoost(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp,
 	int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
+	float BoostStrength = 50000.f;
+
+	// Boost rings carry their own (replicated) state
+	if (const ABoostRing* BoostRing = Cast<ABoostRing>(OtherActor))
+	{
+		if (!BoostRing->IsActive())
+			return;
+
+		BoostStrength = BoostRing->GetBoostStrength();
+	}
+
 	FVector CharLocationRelativeToBoostRing = (OtherActor->GetActorLocation() - GetActorLocation()) - OtherActor->GetActorForwardVector();
 
 	if (CharLocationRelativeToBoostRing.X > 0)
-		GetGravityMovement()->Velocity += OtherActor->GetActorForwardVector() * 50000.f;
+		GetGravityMovement()->Velocity += OtherActor->GetActorForwardVector() * BoostStrength;
 	else
-		GetGravityMovement()->Velocity -= OtherActor->GetActorForwardVector() * 50000.f;
+		GetGravityMovement()->Velocity -= OtherActor->GetActorForwardVector() * BoostStrength;
 }
 
 void AControlCharacter::RotateToGravityDirection()
@@ -0,0 +1,177 @@
+// Remy Pijuan 2024.
+
+#include "ControlReplicationGraph.h"
+#include "CourseActor.h"
+#include "EngineLogs.h"
+#include "GameFramework/Actor.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("ControlRepGraph"), STATGROUP_ControlRepGraph, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Course Path Gather"), STAT_ControlCoursePathGather, STATGROUP_ControlRepGraph);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Course Actors Gathered"), STAT_ControlCourseActorsGathered, STATGROUP_ControlRepGraph);
+
+void UControlCoursePathNode::NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	if (ActorCells.Contains(ActorInfo.Actor))
+	{
+		return;
+	}
+
+	const FIntPoint Cell = GetCell(ActorInfo.Actor->GetActorLocation());
+
+	Cells.FindOrAdd(Cell).Add(ActorInfo.Actor);
+	ActorCells.Add(ActorInfo.Actor, Cell);
+}
+
+bool UControlCoursePathNode::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound)
+{
+	FIntPoint Cell;
+	if (!ActorCells.RemoveAndCopyValue(ActorInfo.Actor, Cell))
+	{
+		UE_CLOG(bWarnIfNotFound, LogNet, Warning, TEXT("UControlCoursePathNode::NotifyRemoveNetworkActor: %s was not found"), *GetNameSafe(ActorInfo.Actor));
+		return false;
+	}
+
+	if (TArray<AActor*>* CellActors = Cells.Find(Cell))
+	{
+		CellActors->RemoveSwap(ActorInfo.Actor);
+	}
+
+	return true;
+}
+
+void UControlCoursePathNode::NotifyResetAllNetworkActors()
+{
+	Super::NotifyResetAllNetworkActors();
+
+	Cells.Reset();
+	ActorCells.Reset();
+	GatheredActors.Reset();
+}
+
+/** Gather the course actors within CullDistance of the path each viewer will take over PredictionTime
+*   Dormant actors are gathered too, the graph skips them for connections they are dormant on
+*/
+void UControlCoursePathNode::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ControlCoursePathGather);
+
+	GatheredActors.Reset();
+
+	TArray<TPair<FVector, FVector>, TInlineAllocator<4>> Paths;
+	FVector BoundsMin(UE_BIG_NUMBER);
+	FVector BoundsMax(-UE_BIG_NUMBER);
+
+	for (const FNetViewer& Viewer : Params.Viewers)
+	{
+		FVector PathOffset = FVector::ZeroVector;
+		if (Viewer.ViewTarget)
+		{
+			PathOffset = (Viewer.ViewTarget->GetVelocity() * PredictionTime).GetClampedToMaxSize(MaxPredictionDistance);
+		}
+
+		const FVector PathStart = Viewer.ViewLocation;
+		const FVector PathEnd = PathStart + PathOffset;
+		Paths.Emplace(PathStart, PathEnd);
+
+		BoundsMin = BoundsMin.ComponentMin(PathStart.ComponentMin(PathEnd));
+		BoundsMax = BoundsMax.ComponentMax(PathStart.ComponentMax(PathEnd));
+	}
+
+	if (Paths.Num() == 0)
+	{
+		return;
+	}
+
+	// Only the cells that could hold an actor within cull distance of a path need checking
+	const FIntPoint MinCell = GetCell(BoundsMin - FVector(CullDistance));
+	const FIntPoint MaxCell = GetCell(BoundsMax + FVector(CullDistance));
+	const float CullDistanceSquared = FMath::Square(CullDistance);
+
+	for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+	{
+		for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+		{
+			const TArray<AActor*>* CellActors = Cells.Find(FIntPoint(CellX, CellY));
+			if (!CellActors)
+			{
+				continue;
+			}
+
+			for (AActor* Actor : *CellActors)
+			{
+				const FVector ActorLocation = Actor->GetActorLocation();
+
+				for (const TPair<FVector, FVector>& Path : Paths)
+				{
+					if (FMath::PointDistToSegmentSquared(ActorLocation, Path.Key, Path.Value) <= CullDistanceSquared)
+					{
+						GatheredActors.Add(Actor);
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_ControlCourseActorsGathered, GatheredActors.Num());
+
+	if (GatheredActors.Num() > 0)
+	{
+		Params.OutGatheredReplicationLists.AddReplicationActorList(GatheredActors);
+	}
+}
+
+FIntPoint UControlCoursePathNode::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UControlReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	// Course actors are distance checked along the player's path by the course path node, so have no cull distance here
+	// Blueprint subclasses loaded later inherit this entry
+	FClassReplicationInfo CourseActorInfo;
+	InitClassReplicationInfo(CourseActorInfo, ACourseActor::StaticClass(), false);
+	CourseActorInfo.SetCullDistanceSquared(0.f);
+	GlobalActorReplicationInfoMap.SetClassInfo(ACourseActor::StaticClass(), CourseActorInfo);
+}
+
+void UControlReplicationGraph::InitGlobalGraphNodes()
+{
+	// Spatial and always relevant actors
+	Super::InitGlobalGraphNodes();
+
+	// Course actors
+	CoursePathNode = CreateNewNode<UControlCoursePathNode>();
+	CoursePathNode->CellSize = CourseCellSize;
+	CoursePathNode->CullDistance = CourseActorCullDistance;
+	CoursePathNode->PredictionTime = PathPredictionTime;
+	CoursePathNode->MaxPredictionDistance = MaxPathPredictionDistance;
+	AddGlobalGraphNode(CoursePathNode);
+}
+
+void UControlReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	// Course actors only ever go to the course path node, bAlwaysRelevant and bOnlyRelevantToOwner are ignored for them
+	if (ActorInfo.Actor->IsA<ACourseActor>())
+	{
+		CoursePathNode->NotifyAddNetworkActor(ActorInfo);
+		return;
+	}
+
+	Super::RouteAddNetworkActorToNodes(ActorInfo, GlobalInfo);
+}
+
+void UControlReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	if (ActorInfo.Actor->IsA<ACourseActor>())
+	{
+		CoursePathNode->NotifyRemoveNetworkActor(ActorInfo);
+		return;
+	}
+
+	Super::RouteRemoveNetworkActorToNodes(ActorInfo);
+}
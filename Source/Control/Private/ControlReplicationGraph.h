@@ -0,0 +1,85 @@
+// Remy Pijuan 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BasicReplicationGraph.h"
+#include "ControlReplicationGraph.generated.h"
+
+/**
+ * Keeps course actors in a coarse grid, and gathers the ones near each viewer or along its predicted path.
+ * Course actors have no class cull distance, so this is the only distance check they get.
+ */
+UCLASS()
+class UControlCoursePathNode : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	// Size of a single grid cell
+	float CellSize = 10000.f;
+
+	// Course actors further than this from a viewer's path are not gathered
+	float CullDistance = 15000.f;
+
+	// How far ahead (in seconds) of the view target's velocity the path goes
+	float PredictionTime = 1.f;
+
+	// Longest path allowed, so boosts don't make the whole course relevant
+	float MaxPredictionDistance = 30000.f;
+
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override;
+	virtual void NotifyResetAllNetworkActors() override;
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+private:
+	// Course actors don't move, so each one stays in the cell it was added to
+	TMap<FIntPoint, TArray<AActor*>> Cells;
+	TMap<AActor*, FIntPoint> ActorCells;
+
+	// Rebuilt for each connection, a connection's lists are replicated before the next connection gathers
+	FActorRepListRefView GatheredActors;
+
+	FIntPoint GetCell(const FVector& Location) const;
+};
+
+/**
+ * Replication graph for the course.
+ * Course actors (ACourseActor) go to the course path node, so they only replicate to connections
+ * in (or heading towards) their area. Everything else is routed as in UBasicReplicationGraph.
+ */
+UCLASS(transient, config=Engine)
+class UControlReplicationGraph : public UBasicReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+
+protected:
+	/** Course Settings */
+
+	// Size of a single cell in the course actor grid
+	UPROPERTY(config)
+	float CourseCellSize = 10000.f;
+
+	// Course actors further than this from the player and their predicted path are not relevant
+	UPROPERTY(config)
+	float CourseActorCullDistance = 15000.f;
+
+	// How far ahead (in seconds) of the player's velocity course actors are considered relevant
+	UPROPERTY(config)
+	float PathPredictionTime = 1.f;
+
+	// Longest predicted path, however fast the player is going
+	UPROPERTY(config)
+	float MaxPathPredictionDistance = 30000.f;
+
+private:
+	UPROPERTY()
+	TObjectPtr<UControlCoursePathNode> CoursePathNode;
+};
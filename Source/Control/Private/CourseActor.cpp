@@ -0,0 +1,42 @@
+// Remy Pijuan 2024.
+
+#include "CourseActor.h"
+#include "Net/UnrealNetwork.h"
+
+// Sets default values
+ACourseActor::ACourseActor()
+{
+	bReplicates = true;
+
+	// Actors placed in the level are already on the client, so they stay dormant until their state changes
+	NetDormancy = DORM_Initial;
+}
+
+void ACourseActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ACourseActor, bIsActive);
+}
+
+void ACourseActor::SetIsActive(bool bNewIsActive)
+{
+	if (HasAuthority() && bIsActive != bNewIsActive)
+	{
+		// Wake the actor before changing state, so the change is sent to clients
+		FlushNetDormancy();
+		bIsActive = bNewIsActive;
+	}
+}
+
+// Called when the game starts or when spawned
+void ACourseActor::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// DORM_Initial only applies to placed actors, spawned ones go dormant after their first replication instead
+	if (HasAuthority() && !IsNetStartupActor() && NetDormancy == DORM_Initial)
+	{
+		SetNetDormancy(DORM_DormantAll);
+	}
+}
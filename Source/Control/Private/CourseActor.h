@@ -0,0 +1,38 @@
+// Remy Pijuan 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "CourseActor.generated.h"
+
+/**
+ * Base for the interactive actors placed on the course (gravity changers, boost rings).
+ * Replicated, but dormant by default: state setters flush dormancy, so an actor only replicates when it changes.
+ */
+UCLASS(Abstract)
+class ACourseActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	// Sets default values for this actor's properties
+	ACourseActor();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// Enable or disable the actor's effect on players (server only)
+	UFUNCTION(BlueprintCallable, Category=Course)
+	void SetIsActive(bool bNewIsActive);
+
+	UFUNCTION(BlueprintPure, Category=Course)
+	bool IsActive() const { return bIsActive; }
+
+protected:
+	// Inactive course actors don't affect players
+	UPROPERTY(EditAnywhere, Replicated, Category=Course)
+	bool bIsActive = true;
+
+	// Called when the game starts or when spawned
+	virtual void BeginPlay() override;
+};
@@ -0,0 +1,21 @@
+// Remy Pijuan 2024.
+
+#include "GravityChanger.h"
+#include "Net/UnrealNetwork.h"
+
+void AGravityChanger::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(AGravityChanger, GravityDirection);
+}
+
+void AGravityChanger::SetGravityDirection(FVector NewGravityDirection)
+{
+	if (HasAuthority() && GravityDirection != NewGravityDirection)
+	{
+		// Flush first so dormant clients receive the new direction
+		FlushNetDormancy();
+		GravityDirection = NewGravityDirection;
+	}
+}
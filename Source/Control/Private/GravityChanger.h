@@ -0,0 +1,31 @@
+// Remy Pijuan 2024.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CourseActor.h"
+#include "GravityChanger.generated.h"
+
+/**
+ * Course actor that changes the player's gravity direction (see AControlCharacter::AlterGravity).
+ */
+UCLASS()
+class AGravityChanger : public ACourseActor
+{
+	GENERATED_BODY()
+
+public:
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// Change the gravity direction given to players (server only)
+	UFUNCTION(BlueprintCallable, Category=Gravity)
+	void SetGravityDirection(FVector NewGravityDirection);
+
+	UFUNCTION(BlueprintPure, Category=Gravity)
+	FVector GetGravityDirection() const { return GravityDirection; }
+
+protected:
+	// The gravity direction given to players that use this changer
+	UPROPERTY(EditAnywhere, Replicated, Category=Gravity)
+	FVector GravityDirection = { 0, 0, 1 };
+};